@@ -6,7 +6,7 @@
      \\/     M anipulation  |
 -------------------------------------------------------------------------------
     Copyright (C) 2012-2015 OpenFOAM Foundation
-    Copyright (C) 2019-2023 OpenCFD Ltd.
+    Copyright (C) 2019-2024 OpenCFD Ltd.
 -------------------------------------------------------------------------------
 License
     This file is part of OpenFOAM.
@@ -191,6 +191,78 @@ void Foam::PstreamDetail::allReduce
     }
     else
 #endif
+    if (UPstream::usingHostHierarchy(comm))
+    {
+        // Two-level: reduce onto the host leader (rank 0 of the host),
+        // allreduce between host leaders, broadcast within the host
+        profilingPstream::beginTiming();
+
+        const label intraComm = UPstream::commIntraHost();
+        const label interComm = UPstream::commInterHost();
+
+        const bool isLeader = UPstream::master(intraComm);
+
+        if
+        (
+            MPI_Reduce
+            (
+                (isLeader ? MPI_IN_PLACE : values),
+                values,
+                count,
+                datatype,
+                optype,
+                0,  // host leader
+                PstreamGlobals::MPICommunicators_[intraComm]
+            )
+        )
+        {
+            FatalErrorInFunction
+                << "MPI_Reduce (intra-host) failed for "
+                << UList<Type>(values, count)
+                << Foam::abort(FatalError);
+        }
+
+        if
+        (
+            isLeader
+         && MPI_Allreduce
+            (
+                MPI_IN_PLACE,  // recv is also send
+                values,
+                count,
+                datatype,
+                optype,
+                PstreamGlobals::MPICommunicators_[interComm]
+            )
+        )
+        {
+            FatalErrorInFunction
+                << "MPI_Allreduce (inter-host) failed for "
+                << UList<Type>(values, count)
+                << Foam::abort(FatalError);
+        }
+
+        if
+        (
+            MPI_Bcast
+            (
+                values,
+                count,
+                datatype,
+                0,  // host leader
+                PstreamGlobals::MPICommunicators_[intraComm]
+            )
+        )
+        {
+            FatalErrorInFunction
+                << "MPI_Bcast (intra-host) failed for "
+                << UList<Type>(values, count)
+                << Foam::abort(FatalError);
+        }
+
+        profilingPstream::addReduceTime();
+    }
+    else
     {
         profilingPstream::beginTiming();
 